@@ -3,13 +3,32 @@
 #include "Project/Public/Components/InteractableComponent.h"
 
 #include "Project/Public/Components/InteractorComponent.h"
+#include "Project/Public/Subsystems/InteractionSubsystem.h"
+
+#include <Runtime/Engine/Classes/Components/PrimitiveComponent.h>
+#include <Runtime/Engine/Classes/Engine/World.h>
+#include <Runtime/Engine/Classes/GameFramework/Actor.h>
+
+/* --------------------------------- Namespace ----------------------------------- */
+
+namespace InteractableComponentDefs
+{
+	constexpr int32 DefaultHighlightStencilValue = 252;
+}
 
 /* ---------------------------- Method Definitions ------------------------------- */
 
 UInteractableComponent::UInteractableComponent(const FObjectInitializer& ObjectInitializer)
 	: bInteractable(true)
+	, bHighlightOnFocus(false)
+	, HighlightStencilValue(InteractableComponentDefs::DefaultHighlightStencilValue)
+	, bHighlightPrimitivesCached(false)
+	, bHighlighted(false)
+	, HighlightRequestCount(0)
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Nothing to do per frame; interactables are driven entirely by interactors. 
+	// Keeps streamed in cells from registering hundreds of tick functions at once.
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
 }
 
@@ -18,13 +37,41 @@ UInteractableComponent::UInteractableComponent(const FObjectInitializer& ObjectI
 void UInteractableComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<UInteractionSubsystem>())
+		{
+			InteractionSubsystem->RegisterInteractable(this);
+		}
+	}
 }
 
 /* ------------------------------------------------------------------------------- */
 
-void UInteractableComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	HighlightRequestCount = 0;
+	ApplyHighlight(false);
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<UInteractionSubsystem>())
+		{
+			// Streamed out levels are dropped from the registry in one batch by the subsystem, but a level removed
+			// before it ever became visible never gets that callback, so clear this out of its pending list here.
+			if (EndPlayReason == EEndPlayReason::RemovedFromWorld)
+			{
+				InteractionSubsystem->DiscardPendingInteractable(this);
+			}
+			else
+			{
+				InteractionSubsystem->UnregisterInteractable(this);
+			}
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 /* ------------------------------------------------------------------------------- */
@@ -72,3 +119,118 @@ bool UInteractableComponent::SetPhysicsActive(bool bActive /*= false*/)
 }
 
 /* ------------------------------------------------------------------------------- */
+
+bool UInteractableComponent::SetHighlighted(const bool bActive /*= false*/)
+{
+	// Purely cosmetic, servers never render it.
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		ApplyHighlight(bActive);
+	}
+
+	return bHighlighted;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractableComponent::AddHighlightRequest()
+{
+	if (GetNetMode() == NM_DedicatedServer || !bHighlightOnFocus)
+	{
+		return false;
+	}
+
+	++HighlightRequestCount;
+	ApplyHighlight(true);
+
+	return bHighlighted;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractableComponent::RemoveHighlightRequest()
+{
+	if (HighlightRequestCount > 0 && --HighlightRequestCount == 0)
+	{
+		ApplyHighlight(false);
+	}
+
+	return bHighlighted;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractableComponent::ApplyHighlight(const bool bActive)
+{
+	if (bHighlighted != bActive)
+	{
+		if (bActive)
+		{
+			if (!bHighlightPrimitivesCached)
+			{
+				CacheHighlightPrimitives();
+			}
+
+			const int32 StencilValue = FMath::Clamp(HighlightStencilValue, 0, 255);
+
+			// Save what each primitive had right before we take it over, so anything else using custom depth gets it back.
+			HighlightRestoreStates.SetNum(HighlightPrimitives.Num());
+
+			for (int32 Index = 0; Index < HighlightPrimitives.Num(); ++Index)
+			{
+				UPrimitiveComponent* PrimitiveComponent = HighlightPrimitives[Index];
+				if (IsValid(PrimitiveComponent))
+				{
+					HighlightRestoreStates[Index].bRenderCustomDepth = PrimitiveComponent->bRenderCustomDepth;
+					HighlightRestoreStates[Index].CustomDepthStencilValue = PrimitiveComponent->CustomDepthStencilValue;
+
+					// Both setters early out when unchanged and only mark the render state dirty,
+					// so the renderer picks every primitive up in the same end of frame update.
+					PrimitiveComponent->SetCustomDepthStencilValue(StencilValue);
+					PrimitiveComponent->SetRenderCustomDepth(true);
+				}
+			}
+		}
+		else
+		{
+			for (int32 Index = 0; Index < HighlightPrimitives.Num() && Index < HighlightRestoreStates.Num(); ++Index)
+			{
+				UPrimitiveComponent* PrimitiveComponent = HighlightPrimitives[Index];
+				if (IsValid(PrimitiveComponent))
+				{
+					PrimitiveComponent->SetCustomDepthStencilValue(HighlightRestoreStates[Index].CustomDepthStencilValue);
+					PrimitiveComponent->SetRenderCustomDepth(HighlightRestoreStates[Index].bRenderCustomDepth);
+				}
+			}
+		}
+
+		bHighlighted = bActive;
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+int32 UInteractableComponent::CacheHighlightPrimitives()
+{
+	// Put the old list back the way it was before swapping it out, then relight the new one.
+	const bool bWasHighlighted = bHighlighted;
+	ApplyHighlight(false);
+
+	HighlightPrimitives.Reset();
+	HighlightRestoreStates.Reset();
+	bHighlightPrimitivesCached = true;
+
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		if (const AActor* Owner = GetOwner())
+		{
+			Owner->GetComponents<UPrimitiveComponent>(HighlightPrimitives);
+		}
+	}
+
+	ApplyHighlight(bWasHighlighted);
+
+	return HighlightPrimitives.Num();
+}
+
+/* ------------------------------------------------------------------------------- */
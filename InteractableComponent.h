@@ -13,6 +13,20 @@
 /* ---------------------------- Forward Declarations ----------------------------- */
 
 class UInteractorComponent;
+class UPrimitiveComponent;
+
+/* ------------------------------ Struct Definition ------------------------------ */
+
+/**
+* Highlight Restore Struct. A primitive's own custom depth settings from before the highlight was applied, put back when it's removed.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+struct FInteractableHighlightRestoreState
+{
+	bool bRenderCustomDepth = false;
+	int32 CustomDepthStencilValue = 0;
+};
 
 /* ------------------------------ Class Definition ------------------------------- */
 
@@ -38,13 +52,47 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Sherbert|Component|Interaction", meta = (AllowPrivateAccess = "true"))
 	bool bInteractable;
 
+	/** True = Highlight the owner's primitives through custom depth/stencil while a local interactor is focused on this. */
+	UPROPERTY(EditDefaultsOnly, Category = "Sherbert|Component|Interaction|Highlight", meta = (AllowPrivateAccess = "true"))
+	bool bHighlightOnFocus;
+
+	/** Stencil value written while highlighted. Match this to the one your outline post process material reads. */
+	UPROPERTY(EditDefaultsOnly, Category = "Sherbert|Component|Interaction|Highlight", meta = (AllowPrivateAccess = "true", ClampMin = "0", ClampMax = "255", EditCondition = "bHighlightOnFocus"))
+	int32 HighlightStencilValue;
+
+	/* Primitive components toggled by the highlight. Gathered once, the first time it's highlighted, so neither streaming in nor later focus changes walk the actor. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction|Highlight")
+	TArray<UPrimitiveComponent*> HighlightPrimitives;
+
+	/* True once HighlightPrimitives has been gathered. It can legitimately be empty. */
+	bool bHighlightPrimitivesCached;
+
+	/* True while the highlight is applied to the cached primitives. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction|Highlight")
+	bool bHighlighted;
+
+	/* Custom depth settings each highlight primitive had before the highlight, by index into HighlightPrimitives. */
+	TArray<FInteractableHighlightRestoreState> HighlightRestoreStates;
+
+	/* Number of local interactors currently asking for the highlight. Split-screen players can focus the same interactable. */
+	int32 HighlightRequestCount;
+
 protected:
 
 	virtual void BeginPlay() override;
 
-public:	
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	/**
+	* Highlight method. Applies or removes custom depth/stencil on the cached primitives, if not already in that state.
+	* Each primitive's own settings are saved when applying and put back when removing.
+	* @param bActive : Whether the highlight should be visible.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void ApplyHighlight(const bool bActive);
+
+public:	
 
 	/**
 	* Interaction method. Should be called only by an Interactor Component when the input action is pressed, once.
@@ -95,6 +143,62 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
 	FORCEINLINE bool SetIsInteractable(const bool bIsInteractable = true) { bInteractable = bIsInteractable; return bInteractable; }
 
+	/**
+	* Highlight method. Cosmetic. Turns the highlight on or off on every cached highlight primitive in one pass. Does nothing on dedicated servers.
+	* Stays as set until the next time an interactor's focus moves on to or off of this.
+	* @param bActive : Whether to apply or remove the highlight.
+	* @return bool bHighlighted : True if the highlight is currently applied.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "Sherbert|Component|Interaction|Highlight")
+	bool SetHighlighted(const bool bActive = false);
+
+	/**
+	* Highlight method. Should be called only by an Interactor Component when its focus moves on to this, once per frame.
+	* Requests are counted, so split-screen players focusing the same interactable keep it lit until the last one looks away.
+	* @return bool bHighlighted : True if the highlight is currently applied.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	bool AddHighlightRequest();
+
+	/**
+	* Highlight method. Should be called only by an Interactor Component when its focus moves off this, once per AddHighlightRequest.
+	* @return bool bHighlighted : True if the highlight is still applied for another interactor.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	bool RemoveHighlightRequest();
+
+	/**
+	* Cache method. Rebuilds the list of primitive components that the highlight toggles.
+	* Called automatically the first time this is highlighted. Call it again if meshes are added to or removed from the owner at runtime.
+	* @return int32 : The number of primitive components cached.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "Sherbert|Component|Interaction|Highlight")
+	int32 CacheHighlightPrimitives();
+
+	/**
+	* Getter method. Returns true if this should be highlighted while focused.
+	* @return bool bHighlightOnFocus : True if the highlight feature is enabled on this component.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction|Highlight")
+	FORCEINLINE bool GetHighlightOnFocus() const { return bHighlightOnFocus; }
+
+	/**
+	* Getter method. Returns true if the highlight is currently applied.
+	* @return bool bHighlighted : True if the cached primitives are currently rendering custom depth.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction|Highlight")
+	FORCEINLINE bool GetIsHighlighted() const { return bHighlighted; }
+
 	/* ------------------------------ Events ------------------------------- */
 
 	/**
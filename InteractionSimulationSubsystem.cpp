@@ -0,0 +1,390 @@
+// ©2023 JDSherbert. All Rights Reserved.
+
+#include "Project/Public/Subsystems/InteractionSimulationSubsystem.h"
+
+#include "Project/Public/Components/InteractableComponent.h"
+#include "Project/Public/Components/InteractorComponent.h"
+
+#include <Runtime/Core/Public/Misc/CommandLine.h>
+#include <Runtime/Core/Public/Misc/FileHelper.h>
+#include <Runtime/Core/Public/Misc/Parse.h>
+#include <Runtime/Engine/Classes/Engine/NetDriver.h>
+#include <Runtime/Engine/Classes/Engine/World.h>
+#include <Runtime/Engine/Classes/GameFramework/Character.h>
+#include <Runtime/Engine/Classes/GameFramework/Pawn.h>
+#include <Runtime/Engine/Classes/GameFramework/PlayerStart.h>
+#include <Runtime/Engine/Public/EngineUtils.h>
+
+/* --------------------------------- Namespace ----------------------------------- */
+
+namespace InteractionSimulationSubsystemDefs
+{
+	const TCHAR* PatternSwitch = TEXT("InteractionSim=");
+	const TCHAR* SeedSwitch = TEXT("InteractionSimSeed=");
+	const TCHAR* BotsSwitch = TEXT("InteractionSimBots=");
+	const TCHAR* BotClassSwitch = TEXT("InteractionSimBotClass=");
+	const TCHAR* JitterSwitch = TEXT("InteractionSimJitter=");
+	const TCHAR* ReportSwitch = TEXT("InteractionSimReport=");
+
+	constexpr int32 DefaultSeed = 0;
+	constexpr int32 DefaultNumBots = 0;
+	constexpr float DefaultJitterDegrees = 2.0f;
+	constexpr float DefaultReportInterval = 5.0f;
+
+	// Bots sharing a player start are fanned out around it so they don't all spawn inside each other.
+	constexpr float BotSpawnSpacing = 100.0f;
+}
+
+/* ---------------------------- Method Definitions ------------------------------- */
+
+bool UInteractionSimulationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Bots spawned on a client would only exist locally, so the harness only ever runs with authority.
+	FString PatternPath;
+	return Super::ShouldCreateSubsystem(Outer)
+		&& !IsRunningClientOnly()
+		&& FParse::Value(FCommandLine::Get(), InteractionSimulationSubsystemDefs::PatternSwitch, PatternPath);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	using namespace InteractionSimulationSubsystemDefs;
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	Seed = DefaultSeed;
+	NumBots = DefaultNumBots;
+	JitterDegrees = DefaultJitterDegrees;
+	float ReportSeconds = DefaultReportInterval;
+
+	FString PatternPath;
+	FParse::Value(CommandLine, PatternSwitch, PatternPath);
+	FParse::Value(CommandLine, SeedSwitch, Seed);
+	FParse::Value(CommandLine, BotsSwitch, NumBots);
+	FParse::Value(CommandLine, BotClassSwitch, BotClassPath);
+	FParse::Value(CommandLine, JitterSwitch, JitterDegrees);
+	FParse::Value(CommandLine, ReportSwitch, ReportSeconds);
+	ReportInterval = FMath::Max(0.1f, ReportSeconds);
+
+	if (!LoadPattern(PatternPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("InteractionSim: No steps loaded from pattern file '%s'. The simulation will not run."), *PatternPath);
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::Deinitialize()
+{
+	if (Steps.Num() > 0 && SimulatedInteractors.Num() > 0)
+	{
+		Report(true);
+	}
+
+	for (FInteractionSimulatedInteractor& Bot : SimulatedInteractors)
+	{
+		if (UInteractorComponent* InteractorComponent = Bot.Interactor.Get())
+		{
+			InteractorComponent->ClearViewOverride();
+		}
+	}
+
+	SimulatedInteractors.Empty();
+	SpawnedBots.Empty();
+	Steps.Empty();
+
+	Super::Deinitialize();
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractionSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// A client build was already ruled out above; this catches game builds joining a server with the same arguments.
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("InteractionSim: Ignored on a network client. Run the simulation on the server."));
+		Steps.Reset();
+		return;
+	}
+
+	if (Steps.Num() > 0)
+	{
+		SpawnBots(InWorld);
+
+		StartStats = GetStats();
+		LastReport = StartStats;
+
+		UE_LOG(LogTemp, Display, TEXT("InteractionSim: Started with %d steps, %d bots, seed %d."), Steps.Num(), SimulatedInteractors.Num(), Seed);
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Steps.Num() == 0)
+	{
+		return;
+	}
+
+	// Walk in order rather than swap-removing, so every bot keeps its place and the run stays repeatable.
+	for (int32 Index = 0; Index < SimulatedInteractors.Num(); )
+	{
+		if (SimulatedInteractors[Index].Interactor.IsValid())
+		{
+			StepBot(SimulatedInteractors[Index]);
+			++Index;
+		}
+		else
+		{
+			SimulatedInteractors.RemoveAt(Index);
+		}
+	}
+
+	if (FPlatformTime::Seconds() - LastReport.Time >= ReportInterval)
+	{
+		Report();
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+TStatId UInteractionSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionSimulationSubsystem, STATGROUP_Tickables);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::AddSimulatedInteractor(UInteractorComponent* InteractorComponent)
+{
+	if (InteractorComponent != nullptr && Steps.Num() > 0)
+	{
+		FInteractionSimulatedInteractor& Bot = SimulatedInteractors.AddDefaulted_GetRef();
+		Bot.Interactor = InteractorComponent;
+
+		// Bots stand in for players, so they get a player's scheduling: a focus query every frame, never held back by the budget.
+		InteractorComponent->SetMinimumSignificance(EInteractionSignificance::Critical);
+
+		// Each bot gets its own stream off the one seed, and starts somewhere different in the pattern.
+		Bot.Stream.Initialize(Seed + SimulatedInteractors.Num() - 1);
+		Bot.StepIndex = Bot.Stream.RandRange(0, Steps.Num() - 1) - 1;
+		Bot.FramesRemaining = 0;
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+FInteractionSimulationStats UInteractionSimulationSubsystem::GetStats() const
+{
+	FInteractionSimulationStats Stats = Totals;
+	Stats.Time = FPlatformTime::Seconds();
+
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UNetDriver* NetDriver = World->GetNetDriver())
+		{
+			Stats.ReplicationBytes = static_cast<uint64>(NetDriver->OutTotalBytes);
+			Stats.NumClientConnections = NetDriver->ClientConnections.Num();
+		}
+	}
+
+	return Stats;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractionSimulationSubsystem::LoadPattern(const FString& PatternPath)
+{
+	Steps.Reset();
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *PatternPath))
+	{
+		return false;
+	}
+
+	for (const FString& Line : Lines)
+	{
+		const FString Trimmed = Line.TrimStartAndEnd();
+		if (Trimmed.IsEmpty() || Trimmed.StartsWith(TEXT("#")))
+		{
+			continue;
+		}
+
+		TArray<FString> Tokens;
+		Trimmed.ParseIntoArrayWS(Tokens);
+		if (Tokens.Num() < 3)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("InteractionSim: Skipping malformed pattern line '%s'."), *Trimmed);
+			continue;
+		}
+
+		FInteractionSimulationStep& Step = Steps.AddDefaulted_GetRef();
+		Step.YawOffset = FCString::Atof(*Tokens[0]);
+		Step.PitchOffset = FCString::Atof(*Tokens[1]);
+		Step.Frames = FMath::Max(1, FCString::Atoi(*Tokens[2]));
+		Step.bInteract = Tokens.Num() > 3 && FCString::Atoi(*Tokens[3]) != 0;
+	}
+
+	return Steps.Num() > 0;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::SpawnBots(UWorld& World)
+{
+	if (NumBots <= 0)
+	{
+		return;
+	}
+
+	// Interactors only work on Characters, so anything else would assert the moment it begins play.
+	UClass* BotClass = LoadClass<ACharacter>(nullptr, *BotClassPath);
+	if (BotClass == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("InteractionSim: Could not load bot class '%s' as a Character. Pass a Character class with an Interactor Component via -%s"), *BotClassPath, InteractionSimulationSubsystemDefs::BotClassSwitch);
+		return;
+	}
+
+	TArray<FTransform> SpawnPoints;
+	for (TActorIterator<APlayerStart> It(&World); It; ++It)
+	{
+		SpawnPoints.Add(It->GetActorTransform());
+	}
+	if (SpawnPoints.Num() == 0)
+	{
+		SpawnPoints.Add(FTransform::Identity);
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	for (int32 Index = 0; Index < NumBots; ++Index)
+	{
+		FTransform SpawnTransform = SpawnPoints[Index % SpawnPoints.Num()];
+
+		const int32 Ring = Index / SpawnPoints.Num();
+		if (Ring > 0)
+		{
+			const float Angle = Ring * UE_GOLDEN_RATIO * UE_TWO_PI;
+			const float Radius = FMath::Sqrt(static_cast<float>(Ring)) * InteractionSimulationSubsystemDefs::BotSpawnSpacing;
+			SpawnTransform.AddToTranslation(FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Radius);
+		}
+
+		if (ACharacter* Bot = World.SpawnActor<ACharacter>(BotClass, SpawnTransform, SpawnParams))
+		{
+			Bot->SpawnDefaultController();
+			SpawnedBots.Add(Bot);
+
+			if (UInteractorComponent* InteractorComponent = Bot->FindComponentByClass<UInteractorComponent>())
+			{
+				AddSimulatedInteractor(InteractorComponent);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("InteractionSim: Bot '%s' has no Interactor Component, it will idle."), *Bot->GetName());
+			}
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::StepBot(FInteractionSimulatedInteractor& Bot)
+{
+	UInteractorComponent* InteractorComponent = Bot.Interactor.Get();
+	const AActor* Owner = InteractorComponent->GetOwner();
+	if (Owner == nullptr)
+	{
+		return;
+	}
+
+	if (Bot.FramesRemaining <= 0)
+	{
+		Bot.StepIndex = (Bot.StepIndex + 1) % Steps.Num();
+		const FInteractionSimulationStep& Step = Steps[Bot.StepIndex];
+
+		Bot.FramesRemaining = Step.Frames;
+		Bot.ViewRotation = FRotator
+		(
+			Step.PitchOffset + Bot.Stream.FRandRange(-JitterDegrees, JitterDegrees),
+			Owner->GetActorRotation().Yaw + Step.YawOffset + Bot.Stream.FRandRange(-JitterDegrees, JitterDegrees),
+			0.0f
+		);
+	}
+
+	const APawn* Pawn = Cast<APawn>(Owner);
+	InteractorComponent->SetViewOverride(Pawn ? Pawn->GetPawnViewLocation() : Owner->GetActorLocation(), Bot.ViewRotation);
+
+	// Interact on the step's last frame. Bots are Critical, so they're traced every frame; any step of two or more
+	// frames has had a focus trace from its new view applied by now (batched interactors need one frame more).
+	if (--Bot.FramesRemaining == 0 && Steps[Bot.StepIndex].bInteract)
+	{
+		const UInteractableComponent* Target = InteractorComponent->GetFocusedInteractable();
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		InteractorComponent->Interact(InteractorComponent);
+		Totals.InteractCycles += FPlatformTime::Cycles64() - StartCycles;
+
+		++Totals.InteractionsAttempted;
+		if (Target != nullptr && Target->GetIsInteractable())
+		{
+			++Totals.InteractionsProcessed;
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSimulationSubsystem::Report(const bool bFinal /*= false*/)
+{
+	const FInteractionSimulationStats Now = GetStats();
+	const FInteractionSimulationStats& Since = bFinal ? StartStats : LastReport;
+
+	const double Elapsed = Now.Time - Since.Time;
+	if (Elapsed > 0.0)
+	{
+		const uint64 Attempted = Now.InteractionsAttempted - Since.InteractionsAttempted;
+		const uint64 Processed = Now.InteractionsProcessed - Since.InteractionsProcessed;
+		const double InteractMs = FPlatformTime::ToMilliseconds64(Now.InteractCycles - Since.InteractCycles);
+		const uint64 Bytes = Now.ReplicationBytes >= Since.ReplicationBytes ? Now.ReplicationBytes - Since.ReplicationBytes : 0;
+
+		// Bots have no connections of their own, so without real or replay clients the server has nothing to send.
+		const FString ReplicationText = (Now.NumClientConnections > 0)
+			? FString::Printf(TEXT("%.0f net driver bytes/s to %d connections"), Bytes / Elapsed, Now.NumClientConnections)
+			: FString(TEXT("net driver bytes n/a (no client connections; attach real or replay clients to measure)"));
+
+		UE_LOG(LogTemp, Display, TEXT("InteractionSim%s: %d bots over %.1fs | %.1f interactions/s, %.1f processed/s | %.2f us avg interact time (direct call, network path bypassed) | %s"),
+			bFinal ? TEXT(" (Total)") : TEXT(""),
+			SimulatedInteractors.Num(),
+			Elapsed,
+			Attempted / Elapsed,
+			Processed / Elapsed,
+			Attempted > 0 ? (InteractMs * 1000.0) / Attempted : 0.0,
+			*ReplicationText);
+	}
+
+	if (!bFinal)
+	{
+		LastReport = Now;
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
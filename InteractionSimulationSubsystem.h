@@ -0,0 +1,197 @@
+// ©2023 JDSherbert. All Rights Reserved.
+
+#pragma once
+
+#include <Runtime/Core/Public/CoreMinimal.h>
+
+#include <Runtime/Engine/Public/Subsystems/WorldSubsystem.h>
+
+#include "InteractionSimulationSubsystem.generated.h"
+
+/* ---------------------------- Forward Declarations ----------------------------- */
+
+class APawn;
+class UInteractorComponent;
+
+/* ------------------------------ Struct Definitions ----------------------------- */
+
+/**
+* Simulation Step Struct. One line of a pattern file: where to look relative to the bot's facing, for how long, and whether to interact.
+* Pattern file lines are "<YawOffset> <PitchOffset> <Frames> <Interact 0|1>". Blank lines and lines starting with '#' are ignored.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+struct FInteractionSimulationStep
+{
+	float YawOffset = 0.0f;
+	float PitchOffset = 0.0f;
+	int32 Frames = 1;
+	bool bInteract = false;
+};
+
+/**
+* Simulated Interactor Struct. Per bot cursor into the pattern, with its own seeded stream so every run is repeatable.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+struct FInteractionSimulatedInteractor
+{
+	TWeakObjectPtr<UInteractorComponent> Interactor;
+	FRandomStream Stream;
+	int32 StepIndex = INDEX_NONE;
+	int32 FramesRemaining = 0;
+	FRotator ViewRotation = FRotator::ZeroRotator;
+};
+
+/**
+* Simulation Stats Struct. Totals since the simulation started. Diff two snapshots for a rate.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+struct FInteractionSimulationStats
+{
+	/* Interact calls issued by bots. */
+	uint64 InteractionsAttempted = 0;
+
+	/* Interact calls that reached an interactable that accepted them. */
+	uint64 InteractionsProcessed = 0;
+
+	/* Time spent inside UInteractorComponent::Interact, Blueprint event dispatch included. Bots call it directly, so no network path is timed. */
+	uint64 InteractCycles = 0;
+
+	/* Bytes sent by the world's net driver, to every connection. Only meaningful with real or replay client connections attached. */
+	uint64 ReplicationBytes = 0;
+
+	/* Client connections on the world's net driver. Zero means ReplicationBytes has nothing to measure. */
+	int32 NumClientConnections = 0;
+
+	/* Wall clock time the snapshot was taken at. */
+	double Time = 0.0;
+};
+
+/* ------------------------------ Class Definition ------------------------------- */
+
+/**
+* Interaction Simulation Subsystem Class. Headless load test harness for the interaction path.
+* Only exists when the game is launched with -InteractionSim=<PatternFile>, typically on a dedicated server with -nullrhi.
+* Only runs with authority (standalone, listen or dedicated server); clients launched with the same arguments ignore it.
+* Spawns -InteractionSimBots=<N> characters of -InteractionSimBotClass=<Path> and drives their Interactor Components from the pattern,
+* seeded by -InteractionSimSeed=<Seed>, then logs interaction throughput, time spent in Interact and net driver bytes
+* every -InteractionSimReport=<Seconds>. Run with -UseFixedTimeStep for frame-for-frame repeatable runs.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+UCLASS()
+class SHERBERT_API UInteractionSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	/**
+	* Registration method. Hands an existing interactor over to the simulation, e.g. for scripted setups that spawn their own bots.
+	* The interactor's view is overridden from then on, and it is scheduled as Critical, like a player.
+	* @param InteractorComponent : The interactor to drive.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Sherbert|Subsystem|Interaction|Simulation")
+	void AddSimulatedInteractor(UInteractorComponent* InteractorComponent);
+
+	/**
+	* Getter method. Returns the running totals since the simulation started.
+	* @return FInteractionSimulationStats : Snapshot of the current totals.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	FInteractionSimulationStats GetStats() const;
+
+	/**
+	* Getter method. Returns the number of interactors being driven.
+	* @return int32 : The number of simulated interactors.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Subsystem|Interaction|Simulation")
+	FORCEINLINE int32 GetNumSimulatedInteractors() const { return SimulatedInteractors.Num(); }
+
+private:
+
+	/**
+	* Loads the pattern file given on the command line into Steps.
+	* @param PatternPath : Path to the pattern file.
+	* @return bool : True if at least one step was loaded.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	bool LoadPattern(const FString& PatternPath);
+
+	/**
+	* Spawns the requested number of bots at the world's player starts and registers their interactors.
+	* @param World : The world to spawn into.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void SpawnBots(UWorld& World);
+
+	/**
+	* Advances one bot by a frame: moves to the next step when the current one runs out, and interacts if the step asks for it.
+	* @param Bot : The bot to advance.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void StepBot(FInteractionSimulatedInteractor& Bot);
+
+	/**
+	* Logs throughput since the last report.
+	* @param bFinal : True for the summary logged on shutdown.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void Report(const bool bFinal = false);
+
+	/* The loaded pattern. Every bot walks it from a different seeded start. */
+	TArray<FInteractionSimulationStep> Steps;
+
+	/* Every interactor being driven. */
+	TArray<FInteractionSimulatedInteractor> SimulatedInteractors;
+
+	/* Pawns spawned by the simulation. Kept alive here, destroyed with the world. */
+	UPROPERTY(Transient)
+	TArray<APawn*> SpawnedBots;
+
+	/* Running totals. ReplicationBytes, NumClientConnections and Time are filled in by GetStats. */
+	FInteractionSimulationStats Totals;
+
+	/* Totals at the last report. */
+	FInteractionSimulationStats LastReport;
+
+	/* Totals when the simulation started. */
+	FInteractionSimulationStats StartStats;
+
+	int32 Seed;
+	int32 NumBots;
+	float JitterDegrees;
+	double ReportInterval;
+	FString BotClassPath;
+};
+
+/* ------------------------------------------------------------------------------- */
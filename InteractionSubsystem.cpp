@@ -0,0 +1,505 @@
+// ©2023 JDSherbert. All Rights Reserved.
+
+#include "Project/Public/Subsystems/InteractionSubsystem.h"
+
+#include "Project/Public/Components/InteractableComponent.h"
+#include "Project/Public/Components/InteractorComponent.h"
+
+#include <Runtime/Core/Public/HAL/IConsoleManager.h>
+#include <Runtime/Core/Public/Misc/App.h>
+#include <Runtime/Engine/Classes/Engine/Level.h>
+#include <Runtime/Engine/Classes/Engine/World.h>
+#include <Runtime/Engine/Classes/GameFramework/Actor.h>
+#include <Runtime/Engine/Classes/GameFramework/PlayerController.h>
+
+/* --------------------------------- Namespace ----------------------------------- */
+
+namespace InteractionSubsystemDefs
+{
+	// Top bit of an async trace's UserData says which in-flight buffer the rest indexes into.
+	constexpr uint32 InFlightBufferBit = 1u << 31;
+
+	// Query priority grows with time since the last query, scaled by tier, so nobody starves.
+	constexpr float HighPriorityWeight = 4.0f;
+	constexpr float MediumPriorityWeight = 2.0f;
+	constexpr float LowPriorityWeight = 1.0f;
+}
+
+/* ------------------------------ Console Variables ------------------------------ */
+
+static TAutoConsoleVariable<int32> CVarInteractionMaxQueriesPerFrame(
+	TEXT("Sherbert.Interaction.MaxQueriesPerFrame"),
+	64,
+	TEXT("Max focus queries issued per frame, player controlled interactors excluded. 0 = unlimited. The only budget applied under -UseFixedTimeStep."));
+
+static TAutoConsoleVariable<float> CVarInteractionMaxQueryTimeMs(
+	TEXT("Sherbert.Interaction.MaxQueryTimeMs"),
+	1.0f,
+	TEXT("Max game thread milliseconds spent in synchronous focus traces per frame, player controlled interactors excluded. 0 = unlimited.\n")
+	TEXT("Batched (async) queries are bounded by MaxQueriesPerFrame only. Ignored under -UseFixedTimeStep so runs stay repeatable."));
+
+static TAutoConsoleVariable<float> CVarInteractionHighSignificanceDistance(
+	TEXT("Sherbert.Interaction.HighSignificanceDistance"),
+	1500.0f,
+	TEXT("Interactors closer than this to a viewer are High significance: queried every frame, complex traces."));
+
+static TAutoConsoleVariable<float> CVarInteractionMediumSignificanceDistance(
+	TEXT("Sherbert.Interaction.MediumSignificanceDistance"),
+	5000.0f,
+	TEXT("Interactors closer than this to a viewer are Medium significance. Anything further is Low."));
+
+static TAutoConsoleVariable<float> CVarInteractionMediumQueryInterval(
+	TEXT("Sherbert.Interaction.MediumQueryInterval"),
+	0.1f,
+	TEXT("Seconds between ticks, and so focus queries, for Medium significance interactors."));
+
+static TAutoConsoleVariable<float> CVarInteractionLowQueryInterval(
+	TEXT("Sherbert.Interaction.LowQueryInterval"),
+	0.5f,
+	TEXT("Seconds between ticks, and so focus queries, for Low significance interactors."));
+
+/* ---------------------------- Method Definitions ------------------------------- */
+
+void UInteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	NumRegisteredInteractables = 0;
+	InFlightBufferIndex = 0;
+	FocusQueryDelegate.BindUObject(this, &UInteractionSubsystem::HandleFocusQueryCompleted);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UInteractionSubsystem::HandleLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UInteractionSubsystem::HandleLevelRemovedFromWorld);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	RegisteredLevels.Empty();
+	PendingLevels.Empty();
+	NumRegisteredInteractables = 0;
+
+	QueuedFocusQueries.Empty();
+	InFlightFocusQueries[0].Empty();
+	InFlightFocusQueries[1].Empty();
+	FocusQueryDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Tickable objects run after every tick group, so all interactors have queued by now.
+	FlushFocusQueries();
+}
+
+/* ------------------------------------------------------------------------------- */
+
+TStatId UInteractionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionSubsystem, STATGROUP_Tickables);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::RegisterInteractable(UInteractableComponent* InteractableComponent)
+{
+	if (InteractableComponent != nullptr)
+	{
+		if (ULevel* Level = InteractableComponent->GetComponentLevel())
+		{
+			// A level only becomes visible after all of its actors have begun play, so anything arriving
+			// from a level that isn't visible yet waits to be committed with the rest of its level.
+			if (!Level->bIsVisible)
+			{
+				PendingLevels.FindOrAdd(Level).Add(InteractableComponent);
+				return;
+			}
+
+			RegisteredLevels.FindOrAdd(Level).Add(InteractableComponent);
+			++NumRegisteredInteractables;
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::UnregisterInteractable(UInteractableComponent* InteractableComponent)
+{
+	if (InteractableComponent != nullptr)
+	{
+		if (ULevel* Level = InteractableComponent->GetComponentLevel())
+		{
+			if (FInteractableList* Interactables = RegisteredLevels.Find(Level))
+			{
+				NumRegisteredInteractables -= Interactables->RemoveSingleSwap(InteractableComponent, false);
+			}
+			else
+			{
+				DiscardPendingInteractable(InteractableComponent);
+			}
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::DiscardPendingInteractable(UInteractableComponent* InteractableComponent)
+{
+	if (InteractableComponent != nullptr)
+	{
+		if (ULevel* Level = InteractableComponent->GetComponentLevel())
+		{
+			if (FInteractableList* PendingInteractables = PendingLevels.Find(Level))
+			{
+				PendingInteractables->RemoveSingleSwap(InteractableComponent, false);
+			}
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+int32 UInteractionSubsystem::GetRegisteredInteractables(TArray<UInteractableComponent*>& OutInteractables) const
+{
+	OutInteractables.Reset(NumRegisteredInteractables);
+
+	for (const TPair<TObjectKey<ULevel>, FInteractableList>& Pair : RegisteredLevels)
+	{
+		for (const TWeakObjectPtr<UInteractableComponent>& Interactable : Pair.Value)
+		{
+			if (UInteractableComponent* InteractableComponent = Interactable.Get())
+			{
+				OutInteractables.Add(InteractableComponent);
+			}
+		}
+	}
+
+	return OutInteractables.Num();
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::HandleLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (Level == nullptr || World != GetWorld())
+	{
+		return;
+	}
+
+	// The list was filled as the level's actors began play, spread over the streaming frames; committing it is a single move.
+	FInteractableList Batch;
+	if (FInteractableList* PendingInteractables = PendingLevels.Find(Level))
+	{
+		Batch = MoveTemp(*PendingInteractables);
+		PendingLevels.Remove(Level);
+	}
+
+	if (Batch.Num() > 0)
+	{
+		FInteractableList& Interactables = RegisteredLevels.FindOrAdd(Level);
+		NumRegisteredInteractables += Batch.Num();
+
+		if (Interactables.Num() == 0)
+		{
+			Interactables = MoveTemp(Batch);
+		}
+		else
+		{
+			Interactables.Append(Batch);
+		}
+
+		OnInteractablesAdded.Broadcast(Level, Interactables);
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	// A null level means the whole world is going away, which Deinitialize already covers.
+	if (Level == nullptr || World != GetWorld())
+	{
+		return;
+	}
+
+	PendingLevels.Remove(Level);
+
+	if (FInteractableList* Interactables = RegisteredLevels.Find(Level))
+	{
+		const FInteractableList Batch = MoveTemp(*Interactables);
+		RegisteredLevels.Remove(Level);
+		NumRegisteredInteractables -= Batch.Num();
+		OnInteractablesRemoved.Broadcast(Level, Batch);
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::QueueFocusQuery(UInteractorComponent* InteractorComponent)
+{
+	if (InteractorComponent != nullptr && !InteractorComponent->IsFocusQueryQueued())
+	{
+		InteractorComponent->SetFocusQueryQueued(true);
+		QueuedFocusQueries.Add(InteractorComponent);
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::FlushFocusQueries()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr || QueuedFocusQueries.Num() == 0)
+	{
+		return;
+	}
+
+	using namespace InteractionSubsystemDefs;
+
+	struct FScheduledQuery
+	{
+		UInteractorComponent* Interactor;
+		EInteractionSignificance Significance;
+		float Priority;
+	};
+
+	const double Now = World->GetTimeSeconds();
+
+	GatherViewerLocations(*World);
+
+	// Swap in a fresh in-flight buffer; async queries issued below index into it.
+	InFlightFocusQueries[InFlightBufferIndex].Reset();
+
+	TArray<FScheduledQuery, TInlineAllocator<64>> Candidates;
+	for (const TWeakObjectPtr<UInteractorComponent>& Queued : QueuedFocusQueries)
+	{
+		UInteractorComponent* InteractorComponent = Queued.Get();
+		if (InteractorComponent == nullptr)
+		{
+			continue;
+		}
+
+		const EInteractionSignificance NewSignificance = EvaluateSignificance(*InteractorComponent);
+		InteractorComponent->SetSignificance(NewSignificance, GetTickIntervalForSignificance(NewSignificance));
+
+		// Players are what the frame is for; they go out first and never wait on the budget.
+		if (NewSignificance == EInteractionSignificance::Critical)
+		{
+			double IgnoredSyncSeconds = 0.0;
+			InteractorComponent->SetFocusQueryQueued(false);
+			IssueFocusQuery(*World, *InteractorComponent, NewSignificance, Now, IgnoredSyncSeconds);
+			continue;
+		}
+
+		// How often each tier queues is already set by its tick interval, so here it's only about who goes first.
+		const float Weight = (NewSignificance == EInteractionSignificance::High) ? HighPriorityWeight
+			: (NewSignificance == EInteractionSignificance::Medium) ? MediumPriorityWeight
+			: LowPriorityWeight;
+
+		const double SinceLastQuery = Now - InteractorComponent->GetLastFocusQueryTime();
+		Candidates.Add({ InteractorComponent, NewSignificance, static_cast<float>(SinceLastQuery) * Weight });
+	}
+
+	QueuedFocusQueries.Reset();
+
+	// Most overdue first. Whoever misses out stays queued and keeps accruing priority, so over budget this round-robins by tier.
+	Candidates.StableSort([](const FScheduledQuery& A, const FScheduledQuery& B) { return A.Priority > B.Priority; });
+
+	// Wall clock budgets would change who gets served from run to run, so deterministic runs only count queries.
+	const int32 MaxQueries = CVarInteractionMaxQueriesPerFrame.GetValueOnGameThread();
+	const double MaxSyncSeconds = FApp::UseFixedTimeStep() ? 0.0 : CVarInteractionMaxQueryTimeMs.GetValueOnGameThread() / 1000.0;
+
+	int32 NumIssued = 0;
+	double SyncSeconds = 0.0;
+
+	for (const FScheduledQuery& Candidate : Candidates)
+	{
+		const bool bOverCountBudget = MaxQueries > 0 && NumIssued >= MaxQueries;
+
+		// Only synchronous traces cost this thread anything worth timing; async ones are bounded by count alone.
+		const bool bOverTimeBudget = MaxSyncSeconds > 0.0 && SyncSeconds >= MaxSyncSeconds && !Candidate.Interactor->GetBatchFocusQueries();
+
+		if (bOverCountBudget || bOverTimeBudget)
+		{
+			QueuedFocusQueries.Add(Candidate.Interactor);
+			continue;
+		}
+
+		// Interactors with nothing to trace from don't eat into the budget.
+		double QuerySyncSeconds = 0.0;
+		Candidate.Interactor->SetFocusQueryQueued(false);
+		if (IssueFocusQuery(*World, *Candidate.Interactor, Candidate.Significance, Now, QuerySyncSeconds))
+		{
+			SyncSeconds += QuerySyncSeconds;
+			++NumIssued;
+		}
+	}
+
+	InFlightBufferIndex ^= 1;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+float UInteractionSubsystem::GetTickIntervalForSignificance(const EInteractionSignificance NewSignificance)
+{
+	switch (NewSignificance)
+	{
+		case EInteractionSignificance::Medium:
+			return CVarInteractionMediumQueryInterval.GetValueOnGameThread();
+
+		case EInteractionSignificance::Low:
+			return CVarInteractionLowQueryInterval.GetValueOnGameThread();
+
+		default:
+			return 0.0f;
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::GatherViewerLocations(UWorld& World)
+{
+	ViewerLocations.Reset();
+
+	for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewerLocations.Add(ViewLocation);
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+EInteractionSignificance UInteractionSubsystem::EvaluateSignificance(const UInteractorComponent& InteractorComponent) const
+{
+	// Any player, local or on the server remote, outranks everything else.
+	const APlayerController* PlayerController = InteractorComponent.GetInteractorPlayerController();
+	const EInteractionSignificance MinimumSignificance = InteractorComponent.GetMinimumSignificance();
+	if (PlayerController != nullptr || MinimumSignificance == EInteractionSignificance::Critical)
+	{
+		return EInteractionSignificance::Critical;
+	}
+
+	EInteractionSignificance DistanceSignificance = EInteractionSignificance::High;
+
+	// With no viewers there's nothing to be far from, so don't degrade anyone; the budget still bounds the frame.
+	const AActor* Owner = InteractorComponent.GetOwner();
+	if (Owner != nullptr && ViewerLocations.Num() > 0)
+	{
+		const FVector Location = Owner->GetActorLocation();
+
+		float NearestDistanceSquared = TNumericLimits<float>::Max();
+		for (const FVector& ViewerLocation : ViewerLocations)
+		{
+			NearestDistanceSquared = FMath::Min(NearestDistanceSquared, static_cast<float>(FVector::DistSquared(Location, ViewerLocation)));
+		}
+
+		const float HighDistance = CVarInteractionHighSignificanceDistance.GetValueOnGameThread();
+		const float MediumDistance = CVarInteractionMediumSignificanceDistance.GetValueOnGameThread();
+
+		if (NearestDistanceSquared >= FMath::Square(MediumDistance))
+		{
+			DistanceSignificance = EInteractionSignificance::Low;
+		}
+		else if (NearestDistanceSquared >= FMath::Square(HighDistance))
+		{
+			DistanceSignificance = EInteractionSignificance::Medium;
+		}
+	}
+
+	// Lower values are more significant.
+	return FMath::Min(DistanceSignificance, MinimumSignificance);
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractionSubsystem::IssueFocusQuery(UWorld& World, UInteractorComponent& InteractorComponent, const EInteractionSignificance NewSignificance, const double Now, double& OutSyncSeconds)
+{
+	OutSyncSeconds = 0.0;
+	InteractorComponent.MarkFocusQueried(Now);
+
+	FInteractionFocusQuery Query;
+	if (!InteractorComponent.BuildFocusQuery(Query))
+	{
+		return false;
+	}
+
+	// Nobody is close enough to tell the difference between complex and simple collision.
+	if (NewSignificance == EInteractionSignificance::Medium || NewSignificance == EInteractionSignificance::Low)
+	{
+		Query.Params.bTraceComplex = false;
+	}
+
+	if (InteractorComponent.GetBatchFocusQueries())
+	{
+		TArray<TWeakObjectPtr<UInteractorComponent>>& InFlight = InFlightFocusQueries[InFlightBufferIndex];
+		const uint32 BufferBit = InFlightBufferIndex ? InteractionSubsystemDefs::InFlightBufferBit : 0u;
+		const int32 Index = InFlight.Add(&InteractorComponent);
+
+		World.AsyncLineTraceByChannel
+		(
+			EAsyncTraceType::Single,
+			Query.Start,
+			Query.End,
+			Query.Channel,
+			Query.Params,
+			FCollisionResponseParams::DefaultResponseParam,
+			&FocusQueryDelegate,
+			BufferBit | static_cast<uint32>(Index)
+		);
+
+		return true;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	FHitResult OutHit(ForceInit);
+	World.LineTraceSingleByChannel(OutHit, Query.Start, Query.End, Query.Channel, Query.Params);
+
+	OutSyncSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	InteractorComponent.ApplyFocusHit(OutHit, Query.Start, Query.End);
+
+	return true;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractionSubsystem::HandleFocusQueryCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	const uint32 BufferIndex = (TraceDatum.UserData & InteractionSubsystemDefs::InFlightBufferBit) ? 1 : 0;
+	const int32 Index = static_cast<int32>(TraceDatum.UserData & ~InteractionSubsystemDefs::InFlightBufferBit);
+
+	const TArray<TWeakObjectPtr<UInteractorComponent>>& InFlight = InFlightFocusQueries[BufferIndex];
+	if (InFlight.IsValidIndex(Index))
+	{
+		if (UInteractorComponent* InteractorComponent = InFlight[Index].Get())
+		{
+			const FHitResult Hit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult(ForceInit);
+			InteractorComponent->ApplyFocusHit(Hit, TraceDatum.Start, TraceDatum.End);
+		}
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
@@ -0,0 +1,226 @@
+// ©2023 JDSherbert. All Rights Reserved.
+
+#pragma once
+
+#include <Runtime/Core/Public/CoreMinimal.h>
+
+#include <Runtime/Engine/Public/Subsystems/WorldSubsystem.h>
+#include <Runtime/Engine/Public/WorldCollision.h>
+
+#include "InteractionSubsystem.generated.h"
+
+/* ---------------------------- Forward Declarations ----------------------------- */
+
+class ULevel;
+class UInteractableComponent;
+class UInteractorComponent;
+enum class EInteractionSignificance : uint8;
+
+/* --------------------------------- Delegates ----------------------------------- */
+
+/** Broadcast once per level batch, with every interactable that entered or left the registry alongside it. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInteractableBatchChanged, ULevel* /*Level*/, const TArray<TWeakObjectPtr<UInteractableComponent>>& /*Interactables*/);
+
+/* ------------------------------ Class Definition ------------------------------- */
+
+/**
+* Interaction Subsystem Class. Per world registry of every live Interactable Component, bucketed by owning level.
+* Interactables that stream in with a level (including World Partition cells) are inserted in one batch when the level
+* is added to the world, and dropped in one batch when it is removed, instead of paying an insert/remove each.
+* Also schedules Interactor focus queries. Each tick it ranks the queued interactors by significance, issues players' queries
+* straight away, and serves the rest most overdue first within the per-frame query count and sync trace time budgets.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+UCLASS()
+class SHERBERT_API UInteractionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	/**
+	* Registration method. Should be called only by an Interactable Component on BeginPlay.
+	* If the owning level is still streaming in, the interactable is only appended to that level's pending list (BeginPlay is time-sliced
+	* across frames while streaming), and the whole list is committed in one batch once the level is added to the world.
+	* @param InteractableComponent : The interactable to add to the registry.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void RegisterInteractable(UInteractableComponent* InteractableComponent);
+
+	/**
+	* Unregistration method. Should be called only by an Interactable Component on EndPlay.
+	* Not needed when the owning level is being unloaded, as the whole level is dropped in one batch.
+	* @param InteractableComponent : The interactable to remove from the registry.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void UnregisterInteractable(UInteractableComponent* InteractableComponent);
+
+	/**
+	* Unregistration method. Should be called only by an Interactable Component on EndPlay when its level is being removed.
+	* Only touches the pending list, for levels removed before they ever became visible; committed levels are dropped in one batch.
+	* @param InteractableComponent : The interactable to remove from its level's pending list.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void DiscardPendingInteractable(UInteractableComponent* InteractableComponent);
+
+	/**
+	* Getter method. Collects every registered interactable that is still valid.
+	* @param OutInteractables : Filled with the registered interactables. Emptied first.
+	* @return int32 : The number of interactables collected.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Sherbert|Subsystem|Interaction")
+	int32 GetRegisteredInteractables(TArray<UInteractableComponent*>& OutInteractables) const;
+
+	/**
+	* Getter method. Returns the number of registered interactables, including any that have since been garbage collected.
+	* @return int32 : The number of registry entries across all committed levels.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Subsystem|Interaction")
+	FORCEINLINE int32 GetNumRegisteredInteractables() const { return NumRegisteredInteractables; }
+
+	/**
+	* Batching method. Should be called only by an Interactor Component from its tick. Does nothing if it's already queued.
+	* The query is issued when the subsystem ticks, unless the frame's budget is spent, in which case it stays queued for the next one.
+	* Synchronous queries apply their result straight away; batched (async) ones apply it next frame.
+	* @param InteractorComponent : The interactor that wants its focus updated.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void QueueFocusQuery(UInteractorComponent* InteractorComponent);
+
+	/** Event: Triggers once when a level's interactables are committed to the registry. */
+	FOnInteractableBatchChanged OnInteractablesAdded;
+
+	/** Event: Triggers once when a level's interactables are dropped from the registry. */
+	FOnInteractableBatchChanged OnInteractablesRemoved;
+
+private:
+
+	/**
+	* Level streaming callback. Commits the level's pending list to the registry in one batch.
+	* @param Level : The level that was made visible.
+	* @param World : The world it was added to. Ignored unless it is ours.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void HandleLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	/**
+	* Level streaming callback. Drops every interactable registered or pending under this level in one batch.
+	* @param Level : The level that was hidden or unloaded.
+	* @param World : The world it was removed from. Ignored unless it is ours.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	/**
+	* Batching method. Schedules the queued focus queries against the budget and issues the ones that made it.
+	* Batched queries go out as async traces so they're all resolved together off the game thread; the rest trace synchronously.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void FlushFocusQueries();
+
+	/**
+	* Collects the view point of every player controller in the world, once per flush. 
+	* On clients that's the local players; on servers it's every connected player.
+	* @param World : The world to collect from.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void GatherViewerLocations(UWorld& World);
+
+	/**
+	* Significance method. Ranks an interactor by who controls it and how close it is to the nearest viewer.
+	* @param InteractorComponent : The interactor to rank.
+	* @return EInteractionSignificance : The tier to schedule it at.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	EInteractionSignificance EvaluateSignificance(const UInteractorComponent& InteractorComponent) const;
+
+	/**
+	* Issues one focus query, either into the async batch or as a synchronous trace.
+	* @return bool : True if a query was issued. False if the interactor had no view to trace from.
+	* @param World : The world to trace in.
+	* @param InteractorComponent : The interactor to trace for.
+	* @param NewSignificance : The tier it was scheduled at. Medium and below trace simple collision only.
+	* @param Now : World time, recorded on the interactor.
+	* @param OutSyncSeconds : Seconds spent in the synchronous trace. Async queries report zero, their cost isn't on this thread.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	bool IssueFocusQuery(UWorld& World, UInteractorComponent& InteractorComponent, const EInteractionSignificance NewSignificance, const double Now, double& OutSyncSeconds);
+
+	/**
+	* Returns the tick interval an interactor should run at for a given significance.
+	* @param NewSignificance : The tier.
+	* @return float : Seconds between ticks. Zero for every frame.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	static float GetTickIntervalForSignificance(const EInteractionSignificance NewSignificance);
+
+	/**
+	* Async trace callback. Hands the result back to the interactor that queued it.
+	* @param TraceHandle : The handle of the completed trace.
+	* @param TraceDatum : The trace result. UserData holds the in-flight buffer and index of the interactor.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void HandleFocusQueryCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	using FInteractableList = TArray<TWeakObjectPtr<UInteractableComponent>>;
+
+	/* Interactables committed to the registry, bucketed by owning level. */
+	TMap<TObjectKey<ULevel>, FInteractableList> RegisteredLevels;
+
+	/* Interactables that began play while their level was still streaming in. Committed on LevelAddedToWorld. */
+	TMap<TObjectKey<ULevel>, FInteractableList> PendingLevels;
+
+	/* Running total of RegisteredLevels entries. */
+	int32 NumRegisteredInteractables;
+
+	/* Interactors waiting for their focus query to be issued. Any the budget didn't reach stay for the next frame. */
+	TArray<TWeakObjectPtr<UInteractorComponent>> QueuedFocusQueries;
+
+	/* Interactors whose focus queries are in flight. Double buffered so a flush never overwrites results not yet delivered. */
+	TArray<TWeakObjectPtr<UInteractorComponent>> InFlightFocusQueries[2];
+
+	/* View points of every player this frame. Reused between flushes. */
+	TArray<FVector> ViewerLocations;
+
+	/* Which InFlightFocusQueries buffer the next flush writes to. */
+	uint32 InFlightBufferIndex;
+
+	/* Shared completion delegate for every batched focus query. */
+	FTraceDelegate FocusQueryDelegate;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
+
+/* ------------------------------------------------------------------------------- */
@@ -3,6 +3,7 @@
 #include "Project/Public/Components/InteractorComponent.h"
 
 #include "Project/Public/Components/InteractableComponent.h"
+#include "Project/Public/Subsystems/InteractionSubsystem.h"
 
 #include <Runtime/Engine/Classes/Components/InputComponent.h>
 #include <Runtime/Engine/Classes/GameFramework/Character.h>
@@ -26,8 +27,17 @@ namespace InteractorComponentDefs
 UInteractorComponent::UInteractorComponent(const FObjectInitializer& ObjectInitializer)
 	: InteractInputAction(nullptr)
 	, MaxInteractionRange(InteractorComponentDefs::DefaultMaxInteractionRange)
+	, bBatchFocusQueries(false)
+	, MinimumSignificance(EInteractionSignificance::Low)
+	, Significance(EInteractionSignificance::High)
+	, LastFocusQueryTime(0.0)
+	, bFocusQueryQueued(false)
+	, bHasViewOverride(false)
+	, ViewOverrideLocation(FVector::ZeroVector)
+	, ViewOverrideRotation(FRotator::ZeroRotator)
 	, bHasNewFocus(false)
 	, FocusedInteractableComponent(nullptr)
+	, HighlightedInteractableComponent(nullptr)
 	, bDebugMode(false)
 	, PlayerController(nullptr)
 	, InteractionUITemplate(nullptr)
@@ -50,11 +60,40 @@ void UInteractorComponent::BeginPlay()
 
 /* ------------------------------------------------------------------------------- */
 
+void UInteractorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (HighlightedInteractableComponent != nullptr)
+	{
+		HighlightedInteractableComponent->RemoveHighlightRequest();
+		HighlightedInteractableComponent = nullptr;
+	}
+
+	if (APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		Pawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UInteractorComponent::HandleControllerChanged);
+	}
+
+	DestroyUIWidgets();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+/* ------------------------------------------------------------------------------- */
+
 void UInteractorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	RaycastForInteractable();
+	// The subsystem decides when, and how, this interactor actually gets to trace.
+	UInteractionSubsystem* InteractionSubsystem = GetWorld()->GetSubsystem<UInteractionSubsystem>();
+	if (InteractionSubsystem != nullptr)
+	{
+		InteractionSubsystem->QueueFocusQuery(this);
+	}
+	else
+	{
+		RaycastForInteractable();
+	}
 }
 
 /* ------------------------------------------------------------------------------- */
@@ -77,33 +116,104 @@ void UInteractorComponent::Init()
                 		}
 			}
 			
-			PlayerController = Character->GetPlayerController();
+			PlayerController = Cast<APlayerController>(Character->GetController());
+		}
+	}
+
+	// Pawns are normally spawned before they're possessed, so follow the controller rather than trusting the one we have now.
+	if (APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		Pawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UInteractorComponent::HandleControllerChanged);
+	}
+
+	MakeInteractionUIWidget();
+	MakeNoInteractionUIWidget();
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractorComponent::HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	APlayerController* NewPlayerController = Cast<APlayerController>(NewController);
+	if (NewPlayerController != PlayerController)
+	{
+		UnassignFocusedInteractable();
+		DestroyUIWidgets();
+
+		PlayerController = NewPlayerController;
+
+		MakeInteractionUIWidget();
+		MakeNoInteractionUIWidget();
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractorComponent::UpdateFocusHighlight()
+{
+	if (HighlightedInteractableComponent == FocusedInteractableComponent || GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	if (HighlightedInteractableComponent != nullptr)
+	{
+		HighlightedInteractableComponent->RemoveHighlightRequest();
+		HighlightedInteractableComponent = nullptr;
+	}
+
+	// Outlines are for the viewer only; bots and remote players never light anything up.
+	if (FocusedInteractableComponent != nullptr && PlayerController != nullptr && PlayerController->IsLocalController())
+	{
+		if (FocusedInteractableComponent->GetHighlightOnFocus() && FocusedInteractableComponent->AddHighlightRequest())
+		{
+			HighlightedInteractableComponent = FocusedInteractableComponent;
 		}
 	}
+}
+
+/* ------------------------------------------------------------------------------- */
 
-	InteractionUIInstance = MakeUIWidget(InteractionUITemplate, InteractionUIInstance,, "Interaction UI");
-	NoInteractionUIInstance = MakeUIWidget(NoInteractionUITemplate, NoInteractionUIInstance, "NoInteraction UI"););
+UUserWidget* UInteractorComponent::MakeInteractionUIWidget()
+{
+	InteractionUIInstance = MakeUIWidget(InteractionUITemplate, InteractionUIInstance, TEXT("Interaction UI"));
+	return InteractionUIInstance;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+UUserWidget* UInteractorComponent::MakeNoInteractionUIWidget()
+{
+	NoInteractionUIInstance = MakeUIWidget(NoInteractionUITemplate, NoInteractionUIInstance, TEXT("NoInteraction UI"));
+	return NoInteractionUIInstance;
 }
 
 /* ------------------------------------------------------------------------------- */
 
 UUserWidget* UInteractorComponent::MakeUIWidget(TSubclassOf<UUserWidget> Template, UUserWidget* Instance, FName UIName)
 {
+	// Only local players have a screen to put it on.
+	APlayerController* OwningPlayer = GetInteractorPlayerController();
+	if (OwningPlayer == nullptr || !OwningPlayer->IsLocalController())
+	{
+		return Instance;
+	}
+
 	// Create UI instance widget and apply to PlayerController
 	if (Instance == nullptr && Template != nullptr) 
 	{
 		Instance = CreateWidget<UUserWidget>
 		(
-			GetInteractorPlayerController(),
+			OwningPlayer,
 			Template,
 			UIName
 		);
 	}
 
-	// Shove it into the viewport and collapse it to make it invisible
+	// Shove it into this player's slice of the viewport and collapse it to make it invisible
 	if (Instance != nullptr)
 	{
-		Instance->AddToViewport(0);
+		Instance->AddToPlayerScreen(0);
 		Instance->SetVisibility(ESlateVisibility::Collapsed);
 	}
 
@@ -112,58 +222,142 @@ UUserWidget* UInteractorComponent::MakeUIWidget(TSubclassOf<UUserWidget> Templat
 
 /* ------------------------------------------------------------------------------- */
 
+void UInteractorComponent::DestroyUIWidgets()
+{
+	if (InteractionUIInstance != nullptr)
+	{
+		InteractionUIInstance->RemoveFromParent();
+		InteractionUIInstance = nullptr;
+	}
+
+	if (NoInteractionUIInstance != nullptr)
+	{
+		NoInteractionUIInstance->RemoveFromParent();
+		NoInteractionUIInstance = nullptr;
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
 UInteractableComponent* UInteractorComponent::RaycastForInteractable()
+{
+	FInteractionFocusQuery Query;
+	if (BuildFocusQuery(Query))
+	{
+		FHitResult OutHit(ForceInit);
+
+		if (const UWorld* World = GetWorld())
+		{
+			World->LineTraceSingleByChannel
+			(
+				OutHit,
+				Query.Start, 
+				Query.End, 
+				Query.Channel, 
+				Query.Params
+			);
+		}
+
+		return ApplyFocusHit(OutHit, Query.Start, Query.End);
+	}
+	
+	return nullptr;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+bool UInteractorComponent::BuildFocusQuery(FInteractionFocusQuery& OutQuery) const
 {
 	if (const AActor* Owner = this->GetOwner())
 	{
-		if (const ACharacter* Character = CastChecked<ACharacter>(Owner))
+		FVector camLoc;
+		FRotator camRot;
+
+		if (bHasViewOverride)
+		{
+			camLoc = ViewOverrideLocation;
+			camRot = ViewOverrideRotation;
+		}
+		else if (const ACharacter* Character = CastChecked<ACharacter>(Owner))
 		{
 			if (const AController* Controller = Character->Controller)
 			{
-				FVector camLoc;
-				FRotator camRot;
 				Controller->GetPlayerViewPoint(camLoc, camRot);
-				const FVector TraceStart = camLoc;
-				const FVector Direction = camRot.Vector();
-				const FVector TraceEnd = TraceStart + (Direction * MaxInteractionRange);
-
-				FCollisionQueryParams TraceParams(InteractorComponentDefs::DefaultTraceLineName, true, Owner);
-				TraceParams.AddIgnoredActor(Owner);
-				TraceParams.bDebugQuery = true;
-				TraceParams.bReturnPhysicalMaterial = false;
-				TraceParams.bTraceComplex = true;
-
-				if (const UWorld* World = GetWorld())
-				{
-					FHitResult OutHit(ForceInit);
-					
-					GetWorld()->LineTraceSingleByChannel
-					(
-						OutHit,
-						TraceStart, 
-						TraceEnd, 
-						InteractorComponentDefs::DefaultInteractionCollisionChannel, 
-						TraceParams
-					);
-					
-					if (OutHit.bBlockingHit)
-					{
-						if (const AActor* Actor = OutHit.GetActor())
-						{
-							if (bDebugMode) DebugHit(Actor, TraceStart, TraceEnd);
-							if (UInteractableComponent* InteractableComponent = GetInteractableComponent(Actor))
-							{
-								return AssignFocusedInteractable(InteractableComponent);
-							}
-						}
-					}
-				}
-
-				UnassignFocusedInteractable();
+			}
+			else
+			{
+				return false;
 			}
 		}
+		else
+		{
+			return false;
+		}
+
+		const FVector Direction = camRot.Vector();
+
+		OutQuery.Start = camLoc;
+		OutQuery.End = camLoc + (Direction * MaxInteractionRange);
+		OutQuery.Channel = InteractorComponentDefs::DefaultInteractionCollisionChannel;
+
+		FCollisionQueryParams TraceParams(InteractorComponentDefs::DefaultTraceLineName, true, Owner);
+		TraceParams.AddIgnoredActor(Owner);
+		TraceParams.bDebugQuery = true;
+		TraceParams.bReturnPhysicalMaterial = false;
+		TraceParams.bTraceComplex = true;
+		OutQuery.Params = TraceParams;
+
+		return true;
 	}
-	
+
+	return false;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractorComponent::SetViewOverride(const FVector& Location, const FRotator& Rotation)
+{
+	bHasViewOverride = true;
+	ViewOverrideLocation = Location;
+	ViewOverrideRotation = Rotation;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractorComponent::ClearViewOverride()
+{
+	bHasViewOverride = false;
+}
+
+/* ------------------------------------------------------------------------------- */
+
+void UInteractorComponent::SetSignificance(const EInteractionSignificance NewSignificance, const float TickInterval)
+{
+	if (Significance != NewSignificance)
+	{
+		Significance = NewSignificance;
+		SetComponentTickInterval(TickInterval);
+	}
+}
+
+/* ------------------------------------------------------------------------------- */
+
+UInteractableComponent* UInteractorComponent::ApplyFocusHit(const FHitResult& Hit, const FVector& TraceStart, const FVector& TraceEnd)
+{
+	if (Hit.bBlockingHit)
+	{
+		if (const AActor* Actor = Hit.GetActor())
+		{
+			if (bDebugMode) DebugHit(Actor, TraceStart, TraceEnd);
+			if (UInteractableComponent* InteractableComponent = GetInteractableComponent(Actor))
+			{
+				return AssignFocusedInteractable(InteractableComponent);
+			}
+		}
+	}
+
+	UnassignFocusedInteractable();
+
 	return nullptr;
 }
 
@@ -181,6 +375,7 @@ UInteractableComponent* UInteractorComponent::AssignFocusedInteractable(UInterac
 			DisplayInteractionUIWidget(true, FocusedInteractableComponent->GetIsInteractable());
 		}
 
+		UpdateFocusHighlight();
 		return FocusedInteractableComponent;
 	}
 
@@ -201,6 +396,7 @@ void UInteractorComponent::UnassignFocusedInteractable()
 		}
         
 		FocusedInteractableComponent = nullptr;
+		UpdateFocusHighlight();
 	}
 }
 
@@ -13,12 +13,51 @@
 
 /* ---------------------------- Forward Declarations ----------------------------- */
 
+class AController;
 class AHUD;
+class APawn;
 class APlayerController;
 class UInteractableComponent;
 class UInputAction;
 class UUserWidget;
 
+/* ------------------------------- Enum Definition ------------------------------- */
+
+/**
+* Interaction Significance Enum. How much an interactor's focus matters right now, decided by the Interaction Subsystem each frame.
+* Lower tiers are queried less often, with cheaper traces, and are first to wait when the frame's query budget runs out.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+UENUM(BlueprintType)
+enum class EInteractionSignificance : uint8
+{
+	/* Player controlled, local or (on the server) remote, or a simulated player. Queried every frame and never held back by the budget. */
+	Critical,
+	/* Near a viewer, or when there are no viewers to measure against. Queried every frame with complex traces while budget allows. */
+	High,
+	/* Mid range. Queried at an interval with simple collision traces. */
+	Medium,
+	/* Far from every viewer. Queried at a long interval with simple collision traces. */
+	Low
+};
+
+/* ------------------------------ Struct Definition ------------------------------ */
+
+/**
+* Focus Query Struct. Everything needed to trace for an interactable from an interactor's view.
+* Built by the interactor so the same query can be run synchronously, or batched by the Interaction Subsystem.
+* @since 18/10/2026
+* @author JDSherbert
+*/
+struct FInteractionFocusQuery
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	ECollisionChannel Channel = ECollisionChannel::ECC_Visibility;
+	FCollisionQueryParams Params;
+};
+
 /* ------------------------------ Class Definition ------------------------------- */
 
 /**
@@ -47,6 +86,39 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sherbert|Component|Interaction", meta = (AllowPrivateAccess = "true"))
 	float MaxInteractionRange;
 
+	/* True = Focus traces run as one async batch with every other interactor's, applied when the engine delivers async trace results 
+	* (a later frame), so focus, highlight and Interact work from an earlier view. Worth it for split-screen; off by default. 
+	* False = Trace synchronously this frame, in the Interaction Subsystem's end of frame flush, counted against its millisecond budget.
+	* Either way the highlight is updated as soon as the result is applied. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sherbert|Component|Interaction", meta = (AllowPrivateAccess = "true"))
+	bool bBatchFocusQueries;
+
+	/* Never drops below this significance however far from a viewer. High for NPCs the game logic depends on, Critical for simulated players. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sherbert|Component|Interaction", meta = (AllowPrivateAccess = "true"))
+	EInteractionSignificance MinimumSignificance;
+
+	/* Significance the Interaction Subsystem last gave this interactor. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
+	EInteractionSignificance Significance;
+
+	/* World time of the last focus query issued for this interactor. */
+	double LastFocusQueryTime;
+
+	/* True while this interactor is waiting in the Interaction Subsystem's queue. Unserved queries carry over to the next frame. */
+	bool bFocusQueryQueued;
+
+	/* True = Focus traces use ViewOverrideLocation/Rotation instead of the controller's view point. Set by SetViewOverride. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
+	bool bHasViewOverride;
+
+	/* View point to trace from while bHasViewOverride is set. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
+	FVector ViewOverrideLocation;
+
+	/* View rotation to trace along while bHasViewOverride is set. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
+	FRotator ViewOverrideRotation;
+
 	/* True only in first frame when focused on new usable actor. */
 	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
 	bool bHasNewFocus;
@@ -55,6 +127,10 @@ private:
 	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
 	UInteractableComponent* FocusedInteractableComponent;
 
+	/* Interactable whose highlight this interactor currently owns. Follows the focus, but stays null for non-local interactors and interactables that don't highlight. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "Sherbert|Component|Interaction")
+	UInteractableComponent* HighlightedInteractableComponent;
+
 	/** Turn on logs and lasers. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sherbert|Component|Interaction", meta = (AllowPrivateAccess = "true"))
 	bool bDebugMode;
@@ -77,6 +153,8 @@ protected:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -90,6 +168,46 @@ protected:
 	*/
 	void Init();
 
+	/**
+	* Highlight method. Cosmetic. Moves the highlight over to the focused interactable.
+	* Called whenever the focus is assigned or unassigned, so the highlight never outlives the focus. 
+	* Only local player interactors highlight, and nothing happens on dedicated servers.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void UpdateFocusHighlight();
+
+	/**
+	* Creates a UUserWidget owned by this interactor's PlayerController and adds it to that player's screen, collapsed.
+	* In split-screen this puts every player's widgets in their own viewport slice.
+	* @param Template : The widget class to create.
+	* @param Instance : The existing instance, if any. Reused rather than recreated.
+	* @param UIName : Name to give the new widget.
+	* @return UUserWidget* : The widget instance. Returns nullptr on fail, or if this interactor isn't a local player.
+	* @since 27/01/2023
+	* @author JDSherbert
+	*/
+	UUserWidget* MakeUIWidget(TSubclassOf<UUserWidget> Template, UUserWidget* Instance, FName UIName);
+
+	/**
+	* Removes both UI widgets from the screen and forgets them, so they can be recreated for a different player.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void DestroyUIWidgets();
+
+	/**
+	* Possession callback. Re-caches the PlayerController and moves the UI over to the new player's screen.
+	* Pawns are usually spawned before they're possessed, so this is what actually sets up the UI for most players.
+	* @param Pawn : The owning pawn.
+	* @param OldController : The controller that was possessing the pawn.
+	* @param NewController : The controller now possessing the pawn.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION()
+	void HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
 public:
 
 	/**
@@ -122,6 +240,124 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Sherbert|Component|Interaction")
 	UInteractableComponent* RaycastForInteractable();
 
+	/**
+	* Query method. Builds the focus trace from the owner's current view point.
+	* @param OutQuery : Filled with the trace to run.
+	* @return bool : True if the owner has a view to trace from.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	bool BuildFocusQuery(FInteractionFocusQuery& OutQuery) const;
+
+	/**
+	* Result method. Focuses the interactable on the hit actor, or unfocuses if nothing interactable was hit.
+	* Called with the result of RaycastForInteractable, or by the Interaction Subsystem when a batched query completes.
+	* @param Hit : The result of the focus trace.
+	* @param TraceStart : Where the trace started. Used for debug drawing.
+	* @param TraceEnd : Where the trace ended. Used for debug drawing.
+	* @return UInteractableComponent* : The Interactable Component that is being looked at.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UInteractableComponent* ApplyFocusHit(const FHitResult& Hit, const FVector& TraceStart, const FVector& TraceEnd);
+
+	/**
+	* Setter method. Makes focus traces come from this view instead of the controller's, until cleared.
+	* Used to drive scripted or bot interactors, such as by the Interaction Simulation Subsystem.
+	* @param Location : The view point to trace from.
+	* @param Rotation : The view rotation to trace along.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Sherbert|Component|Interaction")
+	void SetViewOverride(const FVector& Location, const FRotator& Rotation);
+
+	/**
+	* Unsetter method. Returns focus traces to the controller's view point.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Sherbert|Component|Interaction")
+	void ClearViewOverride();
+
+	/**
+	* Setter method. Should be called only by the Interaction Subsystem each time it ranks this interactor.
+	* When the tier changes, the component's tick interval changes with it, so far interactors don't tick just to queue themselves.
+	* @param NewSignificance : The significance to schedule this at.
+	* @param TickInterval : Seconds between ticks at that significance.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	void SetSignificance(const EInteractionSignificance NewSignificance, const float TickInterval);
+
+	/**
+	* Setter method. Should be called only by the Interaction Subsystem when it issues a focus query for this interactor.
+	* @param Time : World time the query was issued.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	FORCEINLINE void MarkFocusQueried(const double Time) { LastFocusQueryTime = Time; }
+
+	/**
+	* Setter method. Should be called only by the Interaction Subsystem when this enters or leaves its queue.
+	* @param bQueued : True while waiting to be served.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	FORCEINLINE void SetFocusQueryQueued(const bool bQueued) { bFocusQueryQueued = bQueued; }
+
+	/**
+	* Getter method. Returns true if this is waiting in the Interaction Subsystem's queue.
+	* @return bool bFocusQueryQueued : True if queued.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	FORCEINLINE bool IsFocusQueryQueued() const { return bFocusQueryQueued; }
+
+	/**
+	* Getter method. Returns the world time of the last focus query issued for this interactor.
+	* @return double LastFocusQueryTime : World time in seconds.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	FORCEINLINE double GetLastFocusQueryTime() const { return LastFocusQueryTime; }
+
+	/**
+	* Getter method. Returns the significance the Interaction Subsystem last scheduled this interactor at.
+	* @return EInteractionSignificance Significance : The last scheduled significance.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
+	FORCEINLINE EInteractionSignificance GetSignificance() const { return Significance; }
+
+	/**
+	* Getter method. Returns the significance this never drops below.
+	* @return EInteractionSignificance MinimumSignificance : The floor on this interactor's significance.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
+	FORCEINLINE EInteractionSignificance GetMinimumSignificance() const { return MinimumSignificance; }
+
+	/**
+	* Setter method. Sets the significance this never drops below, however far it is from a viewer.
+	* @param NewMinimumSignificance : The floor on this interactor's significance.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Sherbert|Component|Interaction")
+	FORCEINLINE void SetMinimumSignificance(const EInteractionSignificance NewMinimumSignificance) { MinimumSignificance = NewMinimumSignificance; }
+
+	/**
+	* Getter method. Returns true if focus traces should be run as part of the async batch.
+	* @return bool bBatchFocusQueries : True if batched, false if traced synchronously.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
+	FORCEINLINE bool GetBatchFocusQueries() const { return bBatchFocusQueries; }
+
 	/**
 	* Setter method. Assigns the currently focused interactable component into the cache.
 	* Invokes OnLookAt event.
@@ -172,6 +408,15 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
 	FORCEINLINE bool CompareInteractable(UInteractableComponent* NewInteractableComponent) { return NewInteractableComponent == FocusedInteractableComponent; }
 
+	/**
+	* Getter method. Returns the currently focused interactable component in the cache, if there is one.
+	* @return UInteractableComponent* : The focused Interactable Component. Otherwise, returns nullptr.
+	* @since 18/10/2026
+	* @author JDSherbert
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
+	FORCEINLINE UInteractableComponent* GetFocusedInteractable() const { return FocusedInteractableComponent; }
+
 	/**
 	* Getter method. Returns the first Interactable Component from an actor if one exists.
 	* @param Actor : The actor to try get the component from.
@@ -189,7 +434,7 @@ public:
 	* @author JDSherbert
 	*/
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
-	FORCEINLINE AHUD* GetInteractorHUD() const { return GetInteractorPlayerController()->GetHUD(); }
+	FORCEINLINE AHUD* GetInteractorHUD() const { return PlayerController ? PlayerController->GetHUD() : nullptr; }
 
 	/**
 	* Getter method. Returns the owner's PlayerController, if it has one.
@@ -198,7 +443,7 @@ public:
 	* @author JDSherbert
 	*/
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sherbert|Component|Interaction")
-	FORCEINLINE APlayerController* GetInteractorPlayerAgentController() const {return PlayerController; }
+	FORCEINLINE APlayerController* GetInteractorPlayerController() const { return PlayerController; }
 
 	/**
 	* Getter method. Returns the Interaction UI Widget instance, if there is one.